@@ -0,0 +1,1541 @@
+#include "FileManager.h"
+
+#include <map>
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <future>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include <sys/stat.h>
+
+using namespace std;
+using namespace std::filesystem;
+
+// Trim whitespace from both ends
+string trim(const string &str) {
+    size_t first = str.find_first_not_of(" \t\n\r");
+    size_t last = str.find_last_not_of(" \t\n\r");
+
+    if (first == string::npos)
+        return "";
+    return str.substr(first, (last - first + 1));
+}
+
+// Format file size into human-readable string
+string formatFileSize(size_t bytes) {
+    string units[] = {"B", "KB", "MB", "GB"};
+    double size = bytes;
+    int i = 0;
+    
+    while (size >= 1024 && i < 3) {
+        size = size / 1024;
+        i++;
+    }
+    
+    return to_string((int)size) + " " + units[i];
+}
+
+// Parse sizes like "512", "10K", "2M" or "1G"
+static uintmax_t parseFileSize(const string &text) {
+    uintmax_t value = strtoull(text.c_str(), nullptr, 10);
+    char unit = text.empty() ? 'B' : toupper(text.back());
+
+    if (unit == 'K') 
+        value *= 1024;
+    else if (unit == 'M') 
+        value *= 1024 * 1024;
+    else if (unit == 'G') 
+        value *= 1024ull * 1024 * 1024;
+    return value;
+}
+
+// Format time_t into readable string
+string formatTime(time_t t) {
+    char time[20];
+
+    strftime(time, sizeof(time), "%Y-%m-%d %H:%M", localtime(&t));
+    return string(time);
+}
+
+// Records per block in a spill run
+static const size_t kSpillBlockRecords = 256;
+// Smallest amount of open segments worth sealing when a memory budget is set
+static const size_t kMinSegmentBytes = 64 * 1024;
+// Block cache floor so a handful of blocks always fit, even on tiny budgets
+static const size_t kMinCacheBytes = 1024 * 1024;
+// Name ranges a shard is partitioned into while building
+static const size_t kKeyBuckets = 16;
+
+static atomic<uint64_t> nextRunId{1};
+// Keeps run files of concurrent ARIS processes apart
+static const string spillSessionTag = to_string(chrono::system_clock::now().time_since_epoch().count());
+
+// Built-in prune rules, counters for exclude patterns follow these
+enum {
+    kPruneHidden,
+    kPruneDepth,
+    kPruneFilesystem,
+    kPruneMinSize,
+    kPruneMaxSize,
+    kPruneRuleCount
+};
+
+// Longest name or path accepted from an index file
+static const uint32_t kMaxStringBytes = 64 * 1024;
+// Smallest record on disk: two empty strings, size and time
+static const uint64_t kMinRecordBytes = 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+// Header of a saved shard file
+static const char kShardMagic[8] = {'A', 'R', 'I', 'S', 'I', 'D', 'X', '1'};
+
+static string toLower(const string &str) {
+    string lower = str;
+    transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    return lower;
+}
+
+// Roots are keyed by their normalized path, a trailing separator doesn't create a second shard
+static string shardKey(const string &rootPath) {
+    path root = path(rootPath).lexically_normal();
+    if (!root.has_filename() && root.has_parent_path() && root.parent_path() != root.root_path()) {
+        root = root.parent_path();
+    }
+    return root.string();
+}
+
+// Name range of a lowercase key: one bucket below 'a', one above 'z',
+// and the letters spread over the rest
+static size_t keyBucket(const string &key) {
+    unsigned char first = key.empty() ? 0 : (unsigned char)key[0];
+    if (first < 'a') 
+        return 0;
+    if (first > 'z') 
+        return kKeyBuckets - 1;
+    return 1 + (first - 'a') * (kKeyBuckets - 2) / 26;
+}
+
+// Stable file name for a saved shard, FNV-1a of the root path
+static string shardFileName(const string &root) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : root) {
+        hash = (hash ^ c) * 1099511628211ull;
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.idx", (unsigned long long)hash);
+    return name;
+}
+
+// Rough memory cost of one indexed file, including the hash map node
+static size_t estimateBytes(const FileData &fd) {
+    return sizeof(FileData) + fd.name.capacity() + fd.path.capacity() + 64;
+}
+
+static void writeString(ofstream &out, const string &str) {
+    uint32_t len = (uint32_t)str.size();
+    out.write((const char *)&len, sizeof(len));
+    out.write(str.data(), len);
+}
+
+static bool readString(ifstream &in, string &str) {
+    uint32_t len = 0;
+    if (!in.read((char *)&len, sizeof(len)) || len > kMaxStringBytes) 
+        return false;
+    str.resize(len);
+    return (bool)in.read(&str[0], len);
+}
+
+static void writeRecord(ofstream &out, const FileData &fd) {
+    uint64_t size = fd.size;
+    int64_t lastMod = fd.lastModified;
+
+    writeString(out, fd.name);
+    writeString(out, fd.path);
+    out.write((const char *)&size, sizeof(size));
+    out.write((const char *)&lastMod, sizeof(lastMod));
+}
+
+static bool readRecord(ifstream &in, FileData &fd) {
+    uint64_t size = 0;
+    int64_t lastMod = 0;
+
+    if (!readString(in, fd.name) || !readString(in, fd.path))
+        return false;
+    if (!in.read((char *)&size, sizeof(size)) || !in.read((char *)&lastMod, sizeof(lastMod)))
+        return false;
+
+    fd.size = (size_t)size;
+    fd.lastModified = (time_t)lastMod;
+    return true;
+}
+
+SpillRun::~SpillRun() {
+    error_code ec;
+    remove(filePath, ec);
+}
+
+// Segment can only hold a match if the prefix falls inside its name range
+bool IndexSegment::canMatch(const string &prefixLower) const {
+    if (fileCount == 0)
+        return false;
+    if (maxKey.compare(0, prefixLower.size(), prefixLower) < 0)
+        return false;
+    if (minKey.compare(0, prefixLower.size(), prefixLower) > 0)
+        return false;
+    return true;
+}
+
+bool RootShard::canMatch(const string &prefixLower) const {
+    for (const auto &segment : segments) {
+        if (segment->canMatch(prefixLower)) 
+            return true;
+    }
+    return false;
+}
+
+void BlockCache::setCapacity(size_t bytes) {
+    lock_guard<mutex> guard(cacheMutex);
+    capacity = bytes;
+    evict();
+}
+
+void BlockCache::clear() {
+    lock_guard<mutex> guard(cacheMutex);
+    lru.clear();
+    lookup.clear();
+    usedBytes = 0;
+}
+
+void BlockCache::readCounters(size_t &hitCount, size_t &missCount, size_t &bytes) const {
+    lock_guard<mutex> guard(cacheMutex);
+    hitCount = hits;
+    missCount = misses;
+    bytes = usedBytes;
+}
+
+void BlockCache::evict() {
+    while (usedBytes > capacity && !lru.empty()) {
+        usedBytes -= lru.back().bytes;
+        lookup.erase(lru.back().key);
+        lru.pop_back();
+    }
+}
+
+shared_ptr<const vector<FileData>> BlockCache::get(const SpillRun &run, size_t block) {
+    string key = to_string(run.id) + ":" + to_string(block);
+
+    {
+        lock_guard<mutex> guard(cacheMutex);
+        auto found = lookup.find(key);
+        if (found != lookup.end()) {
+            hits++;
+            lru.splice(lru.begin(), lru, found->second);
+            return found->second->records;
+        }
+        misses++;
+    }
+
+    // Page the block back in from its run, outside the lock so other shards keep going
+    auto records = make_shared<vector<FileData>>();
+    ifstream in(run.filePath, ios::binary);
+    if (!in.is_open()) {
+        cout << "Warning: Could not read spilled index " << run.filePath << ", results may be incomplete" << endl;
+        return records;
+    }
+    in.seekg(run.blockOffset[block]);
+
+    size_t bytes = 0;
+    for (uint32_t i = 0; i < run.blockCount[block]; i++) {
+        FileData fd;
+        if (!readRecord(in, fd)) {
+            // Leave broken blocks out of the cache so the next search retries the read
+            cout << "Warning: Spilled index " << run.filePath << " is damaged, results may be incomplete" << endl;
+            return records;
+        }
+        bytes += estimateBytes(fd);
+        records->push_back(fd);
+    }
+
+    lock_guard<mutex> guard(cacheMutex);
+    if (bytes <= capacity && lookup.find(key) == lookup.end()) {
+        lru.push_front({key, records, bytes});
+        lookup[key] = lru.begin();
+        usedBytes += bytes;
+        evict();
+    }
+
+    return records;
+}
+
+// Glob match where '*' and '?' stay within one path component and '**' crosses them
+static bool globMatch(const char *pattern, const char *text) {
+    while (*pattern != '\0') {
+        if (*pattern == '*') {
+            bool crossDirs = pattern[1] == '*';
+            while (*pattern == '*') 
+                pattern++;
+
+            // "**/" also matches zero directories
+            if (crossDirs && *pattern == '/' && globMatch(pattern + 1, text)) 
+                return true;
+
+            for (;; text++) {
+                if (globMatch(pattern, text)) 
+                    return true;
+                if (*text == '\0' || (!crossDirs && *text == '/')) 
+                    return false;
+            }
+        }
+
+        if (*text == '\0') 
+            return false;
+        if (*pattern == '?' ? *text == '/' : *pattern != *text) 
+            return false;
+
+        pattern++;
+        text++;
+    }
+    return *text == '\0';
+}
+
+void PruneMatcher::compile(const vector<string> &patterns, bool foldCase) {
+    ignoreCase = foldCase;
+    rules.clear();
+    byName.clear();
+    byExtension.clear();
+    globRules.clear();
+
+    for (const string &raw : patterns) {
+        string glob = ignoreCase ? toLower(trim(raw)) : trim(raw);
+        Rule rule = {"", false, false};
+
+        // Re-inclusion isn't supported, keep the slot but never match
+        if (!glob.empty() && glob[0] == '!') {
+            rules.push_back(rule);
+            continue;
+        }
+
+        if (!glob.empty() && glob.back() == '/') {
+            rule.dirOnly = true;
+            glob.pop_back();
+        }
+        if (glob.compare(0, 3, "**/") == 0 && glob.find('/', 3) == string::npos) {
+            glob = glob.substr(3);
+        }
+        if (glob.find('/') != string::npos) {
+            rule.anchored = true;
+            if (glob[0] == '/') 
+                glob = glob.substr(1);
+        }
+        // "dir/**" excludes the whole folder, so prune the folder itself instead of every child
+        if (glob.size() > 3 && glob.compare(glob.size() - 3, 3, "/**") == 0) {
+            glob.resize(glob.size() - 3);
+            rule.dirOnly = true;
+        }
+        rule.glob = glob;
+
+        // Keep the slot even for empty patterns so indices line up with the counters
+        size_t index = rules.size();
+        rules.push_back(rule);
+        if (glob.empty()) 
+            continue;
+
+        bool wildcard = glob.find_first_of("*?") != string::npos;
+        if (!rule.anchored && !wildcard) {
+            byName[glob].push_back(index);
+        } else if (!rule.anchored && glob.compare(0, 2, "*.") == 0 && glob.find_first_of("*?/.", 2) == string::npos) {
+            // Lookups use the last dot of a name, so only single-dot extensions go here
+            byExtension[glob.substr(1)].push_back(index);
+        } else {
+            globRules.push_back(index);
+        }
+    }
+}
+
+bool PruneMatcher::ruleMatches(size_t index, const string &name, const string &relativePath, bool isDir) const {
+    const Rule &rule = rules[index];
+    if (rule.dirOnly && !isDir) 
+        return false;
+    return globMatch(rule.glob.c_str(), rule.anchored ? relativePath.c_str() : name.c_str());
+}
+
+int PruneMatcher::match(const string &entryName, const string &entryPath, bool isDir) const {
+    // Patterns were lowercased at compile time when ignoring case
+    string foldedName;
+    string foldedPath;
+    if (ignoreCase) {
+        foldedName = toLower(entryName);
+        foldedPath = toLower(entryPath);
+    }
+    const string &name = ignoreCase ? foldedName : entryName;
+    const string &relativePath = ignoreCase ? foldedPath : entryPath;
+
+    int best = -1;
+    auto consider = [&](size_t index) {
+        if ((best < 0 || (int)index < best) && ruleMatches(index, name, relativePath, isDir)) 
+            best = (int)index;
+    };
+
+    auto named = byName.find(name);
+    if (named != byName.end()) {
+        for (size_t index : named->second) 
+            consider(index);
+    }
+
+    size_t dotPos = name.find_last_of('.');
+    if (dotPos != string::npos) {
+        auto typed = byExtension.find(name.substr(dotPos));
+        if (typed != byExtension.end()) {
+            for (size_t index : typed->second) 
+                consider(index);
+        }
+    }
+
+    for (size_t index : globRules) {
+        consider(index);
+    }
+    return best;
+}
+
+// Device a path lives on, used to stay on one filesystem
+static bool deviceOf(const path &p, uint64_t &device) {
+    struct stat st;
+    if (stat(p.string().c_str(), &st) != 0) {
+        return false;
+    }
+    device = (uint64_t)st.st_dev;
+    return true;
+}
+
+// Walk a path and hand every regular file to the visitor.
+// Pruned directories have recursion disabled before the iterator opens them.
+void FileManager::walkFiles(const string &rootPath, const function<void(const FileData &)> &visit, bool applyPrune) {
+    if (!exists(rootPath) || !is_directory(rootPath)) {
+        return;
+    }
+
+    // Work on a copy of the rules and tally locally, other crawls may run at the same time.
+    // Without pruning the defaults below let everything through.
+    PruneRules rules;
+    PruneMatcher matcher;
+    vector<PruneCounter> tally;
+    if (applyPrune) {
+        lock_guard<mutex> guard(pruneMutex);
+        rules = pruneRules;
+        matcher = pruneMatcher;
+        tally.resize(pruneCounters.size());
+    }
+
+    path root(rootPath);
+    uint64_t rootDevice = 0;
+    bool checkDevice = rules.oneFilesystem && deviceOf(root, rootDevice);
+
+    try {
+        error_code ec;
+        recursive_directory_iterator it(rootPath, directory_options::skip_permission_denied, ec);
+
+        for (; !ec && it != recursive_directory_iterator(); it.increment(ec)) {
+            const directory_entry &entry = *it;
+
+            try {
+                path filePath = entry.path();
+                string fileName = filePath.filename().string();
+                bool isDir = entry.is_directory();
+                int rule = -1;
+
+                if (rules.skipHidden && fileName[0] == '.') {
+                    rule = kPruneHidden;
+                } else if (tally.size() > kPruneRuleCount) {
+                    string relativePath = filePath.lexically_relative(root).generic_string();
+                    int pattern = matcher.match(fileName, relativePath, isDir);
+                    if (pattern >= 0) 
+                        rule = kPruneRuleCount + pattern;
+                }
+
+                if (isDir) {
+                    if (rule < 0 && rules.maxDepth >= 0 && it.depth() >= rules.maxDepth) {
+                        rule = kPruneDepth;
+                    }
+                    uint64_t device = 0;
+                    if (rule < 0 && checkDevice && deviceOf(filePath, device) && device != rootDevice) {
+                        rule = kPruneFilesystem;
+                    }
+                    if (rule >= 0) {
+                        it.disable_recursion_pending();
+                        tally[rule].dirs++;
+                    }
+                    continue;
+                }
+
+                if (!entry.is_regular_file()) 
+                    continue;
+
+                size_t fileSize = file_size(filePath);
+                if (rule < 0 && fileSize < rules.minFileSize) {
+                    rule = kPruneMinSize;
+                }
+                if (rule < 0 && rules.maxFileSize > 0 && fileSize > rules.maxFileSize) {
+                    rule = kPruneMaxSize;
+                }
+                if (rule >= 0) {
+                    tally[rule].files++;
+                    continue;
+                }
+
+                string absolutePath = absolute(filePath).string();
+                
+                auto ftime = last_write_time(filePath);
+                // Convert filesystem time to system time
+                auto stime = chrono::time_point_cast<chrono::system_clock::duration>(
+                    ftime - file_time_type::clock::now() + chrono::system_clock::now()
+                );
+                time_t lastMod = chrono::system_clock::to_time_t(stime);
+
+                // Store file data
+                FileData fd;
+                fd.name = fileName;
+                fd.path = absolutePath;
+                fd.size = fileSize;
+                fd.lastModified = lastMod;
+                
+                visit(fd);
+            } catch (...) {
+                continue;
+            }
+        }
+    } catch (...) {
+    }
+
+    if (!applyPrune) {
+        return;
+    }
+    lock_guard<mutex> guard(pruneMutex);
+    if (tally.size() == pruneCounters.size()) {
+        for (size_t i = 0; i < tally.size(); i++) {
+            pruneCounters[i].dirs += tally[i].dirs;
+            pruneCounters[i].files += tally[i].files;
+        }
+    }
+}
+
+// Collect files from a given path
+vector<FileData> FileManager::collectFilesFromPath(const string &rootPath) {
+    vector<FileData> files;
+
+    walkFiles(rootPath, [&files](const FileData &fd) {
+        files.push_back(fd);
+    }, false);
+
+    return files;
+}
+
+void FileManager::buildIndex(const string &rootPath) {
+    // Check if path exists
+    if (!exists(rootPath)) {
+        cout << "  Skipping (doesn't exist): " << rootPath << endl;
+        return;
+    }
+    
+    if (!is_directory(rootPath)) {
+        cout << "  Skipping (not a directory): " << rootPath << endl;
+        return;
+    }
+
+    // Crawl into a private shard without holding indexMutex, searches keep
+    // using the old shard and other writers only wait for seals and the swap
+    ShardBuilder builder;
+    builder.shard.root = shardKey(rootPath);
+
+    walkFiles(rootPath, [&](const FileData &fd) {
+        addToShard(builder, fd);
+    }, true);
+
+    lock_guard<mutex> guard(indexMutex);
+    finishShard(builder);
+    installShard(builder.shard);
+}
+
+// Index for multiple directories, dropping roots that are no longer listed.
+// Roots that already have a shard are only re-crawled when refresh is set.
+void FileManager::buildFullIndex(const vector<string> &paths, bool refresh) {
+    vector<string> keep;
+    for (const string &path : paths) {
+        keep.push_back(shardKey(path));
+    }
+    for (const string &root : indexedRoots()) {
+        if (find(keep.begin(), keep.end(), root) == keep.end()) 
+            dropRoot(root);
+    }
+
+    vector<string> indexed = indexedRoots();
+    for (const string &path : paths) {
+        if (!refresh && find(indexed.begin(), indexed.end(), shardKey(path)) != indexed.end()) {
+            cout << "Already indexed: " << path << endl;
+            continue;
+        }
+        cout << "Indexing: " << path << "..." << endl;
+        buildIndex(path);
+    }
+    cout << "Indexing complete!" << endl;
+}
+
+bool FileManager::dropRoot(const string &rootPath) {
+    lock_guard<mutex> guard(indexMutex);
+    return removeShard(shardKey(rootPath));
+}
+
+vector<string> FileManager::indexedRoots() const {
+    vector<string> roots;
+    for (const auto &entry : currentSnapshot()->shards) {
+        roots.push_back(entry.first);
+    }
+    return roots;
+}
+
+shared_ptr<const IndexSnapshot> FileManager::currentSnapshot() const {
+    return atomic_load(&snapshot);
+}
+
+// Copy the shard map with one root replaced or removed and swap it in.
+// Searches still running on the old snapshot keep its shards alive until they finish.
+void FileManager::publishShard(const string &root, shared_ptr<const RootShard> shard) {
+    auto next = make_shared<IndexSnapshot>(*currentSnapshot());
+    if (shard) {
+        next->shards[root] = shard;
+    } else {
+        next->shards.erase(root);
+    }
+    atomic_store(&snapshot, shared_ptr<const IndexSnapshot>(next));
+}
+
+bool FileManager::removeShard(const string &root) {
+    auto current = currentSnapshot();
+    auto found = current->shards.find(root);
+    if (found == current->shards.end()) {
+        return false;
+    }
+
+    for (const auto &segment : found->second->segments) {
+        if (!segment->isSpilled()) 
+            residentBytes -= segment->bytes;
+    }
+    publishShard(root, nullptr);
+    unsavedRoots.erase(root);
+    droppedRoots.insert(root);
+    return true;
+}
+
+// Add one file to the open segment of its name range. Once the open segments
+// reach their share of the budget, the largest is sealed so it can spill on its own.
+void FileManager::addToShard(ShardBuilder &builder, const FileData &fd) {
+    string key = toLower(fd.name);
+    size_t bucket = keyBucket(key);
+
+    if (builder.open.empty()) {
+        builder.open.resize(kKeyBuckets);
+    }
+    if (!builder.open[bucket]) {
+        builder.open[bucket] = make_shared<IndexSegment>();
+    }
+    IndexSegment &current = *builder.open[bucket];
+
+    if (current.fileCount == 0 || key < current.minKey) 
+        current.minKey = key;
+    if (key > current.maxKey) 
+        current.maxKey = key;
+
+    size_t bytes = estimateBytes(fd);
+    current.indexByName[fd.name].push_back(fd);
+    current.bytes += bytes;
+    current.fileCount++;
+    builder.openBytes += bytes;
+
+    if (memoryBudget > 0 && builder.openBytes >= max(memoryBudget / 8, kMinSegmentBytes)) {
+        size_t largest = 0;
+        for (size_t i = 1; i < builder.open.size(); i++) {
+            if (builder.open[i] && (!builder.open[largest] || builder.open[i]->bytes > builder.open[largest]->bytes)) 
+                largest = i;
+        }
+        lock_guard<mutex> guard(indexMutex);
+        sealSegment(builder, largest);
+    }
+}
+
+void FileManager::sealSegment(ShardBuilder &builder, size_t bucket) {
+    shared_ptr<IndexSegment> segment = builder.open[bucket];
+    builder.open[bucket].reset();
+    builder.openBytes -= segment->bytes;
+
+    segment->lastUsed = useClock.load();
+    residentBytes += segment->bytes;
+    builder.shard.fileCount += segment->fileCount;
+    builder.shard.segments.push_back(segment);
+    enforceMemoryBudget(&builder.shard);
+}
+
+// Seal whatever is still open once all files are added
+void FileManager::finishShard(ShardBuilder &builder) {
+    for (size_t i = 0; i < builder.open.size(); i++) {
+        if (builder.open[i]) 
+            sealSegment(builder, i);
+    }
+}
+
+// Replace any previous shard for the same root
+void FileManager::installShard(RootShard &shard, bool unsaved) {
+    string root = shard.root;
+    droppedRoots.erase(root);
+    if (unsaved) {
+        unsavedRoots.insert(root);
+    } else {
+        unsavedRoots.erase(root);
+    }
+
+    auto finished = make_shared<const RootShard>(move(shard));
+
+    auto current = currentSnapshot();
+    auto found = current->shards.find(root);
+    if (found != current->shards.end()) {
+        for (const auto &segment : found->second->segments) {
+            if (!segment->isSpilled()) 
+                residentBytes -= segment->bytes;
+        }
+    }
+    publishShard(root, finished);
+}
+
+// Spill least recently searched segments until the resident index fits.
+// Half the budget goes to resident segments, a quarter to the block cache,
+// the rest is headroom for the segment currently being filled.
+// Published shards are never changed in place, a spill publishes a copy
+// of the shard that points at the spilled segment instead.
+void FileManager::enforceMemoryBudget(RootShard *building) {
+    if (memoryBudget == 0) {
+        return;
+    }
+
+    // Memory of the shard a build replaces is released on install, so it doesn't count here
+    size_t replacedBytes = 0;
+    if (building != nullptr) {
+        auto current = currentSnapshot();
+        auto found = current->shards.find(building->root);
+        if (found != current->shards.end()) {
+            for (const auto &segment : found->second->segments) {
+                if (!segment->isSpilled()) 
+                    replacedBytes += segment->bytes;
+            }
+        }
+    }
+
+    while (residentBytes - replacedBytes > memoryBudget / 2) {
+        shared_ptr<const RootShard> coldestShard;
+        size_t coldestIndex = 0;
+        const IndexSegment *coldest = nullptr;
+
+        auto consider = [&](const RootShard &shard, const shared_ptr<const RootShard> &owner) {
+            for (size_t i = 0; i < shard.segments.size(); i++) {
+                const IndexSegment &segment = *shard.segments[i];
+                if (segment.isSpilled()) 
+                    continue;
+                if (coldest == nullptr || segment.lastUsed < coldest->lastUsed) {
+                    coldest = &segment;
+                    coldestShard = owner;
+                    coldestIndex = i;
+                }
+            }
+        };
+
+        // The shard a build is about to replace is thrown away on install, don't spill it
+        auto current = currentSnapshot();
+        for (const auto &entry : current->shards) {
+            if (building != nullptr && entry.first == building->root) 
+                continue;
+            consider(*entry.second, entry.second);
+        }
+        if (building != nullptr) {
+            consider(*building, nullptr);
+        }
+        if (coldest == nullptr) {
+            break;
+        }
+
+        auto spilled = spillSegment(*coldest);
+        if (!spilled) {
+            break;
+        }
+        residentBytes -= coldest->bytes;
+
+        if (coldestShard) {
+            auto next = make_shared<RootShard>(*coldestShard);
+            next->segments[coldestIndex] = spilled;
+            publishShard(next->root, next);
+        } else {
+            building->segments[coldestIndex] = spilled;
+        }
+    }
+}
+
+// Write a segment to a run and return its spilled replacement
+shared_ptr<const IndexSegment> FileManager::spillSegment(const IndexSegment &segment) {
+    error_code ec;
+    if (spillDirectory.empty()) {
+        spillDirectory = (temp_directory_path(ec) / "aris_spill").string();
+    }
+    create_directories(spillDirectory, ec);
+
+    // Runs are sorted by lowercase name so a prefix maps to a contiguous block range
+    vector<pair<string, const FileData *>> sorted;
+    sorted.reserve(segment.fileCount);
+    for (const auto &entry : segment.indexByName) {
+        string key = toLower(entry.first);
+        for (const auto &fd : entry.second) {
+            sorted.emplace_back(key, &fd);
+        }
+    }
+    sort(sorted.begin(), sorted.end(), [](const pair<string, const FileData *> &a, const pair<string, const FileData *> &b) {
+        return a.first < b.first;
+    });
+
+    auto run = make_shared<SpillRun>();
+    run->id = nextRunId++;
+    run->filePath = (path(spillDirectory) / ("aris_" + spillSessionTag + "_" + to_string(run->id) + ".run")).string();
+
+    ofstream out(run->filePath, ios::binary);
+    if (!out.is_open()) {
+        cout << "Warning: Could not spill index to " << run->filePath << endl;
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < sorted.size(); i++) {
+        if (i % kSpillBlockRecords == 0) {
+            run->blockFirstKey.push_back(sorted[i].first);
+            run->blockOffset.push_back((uint64_t)out.tellp());
+            run->blockCount.push_back(0);
+        }
+        writeRecord(out, *sorted[i].second);
+        run->blockCount.back()++;
+    }
+
+    out.close();
+    if (out.fail()) {
+        cout << "Warning: Could not spill index to " << run->filePath << endl;
+        return nullptr;
+    }
+
+    auto spilled = make_shared<IndexSegment>();
+    spilled->minKey = segment.minKey;
+    spilled->maxKey = segment.maxKey;
+    spilled->fileCount = segment.fileCount;
+    spilled->bytes = segment.bytes;
+    spilled->lastUsed = segment.lastUsed.load();
+    spilled->run = run;
+    return spilled;
+}
+
+void FileManager::setMemoryBudget(size_t bytes) {
+    lock_guard<mutex> guard(indexMutex);
+    memoryBudget = bytes;
+    // Keep the cache floor without a budget too, for runs that can't be paged back in
+    blockCache.setCapacity(max(bytes / 4, kMinCacheBytes));
+    enforceMemoryBudget();
+    pageInSegments();
+}
+
+// Read spilled segments back into memory, most recently searched first,
+// while they fit the budget. Without a budget everything comes back.
+void FileManager::pageInSegments() {
+    auto current = currentSnapshot();
+
+    // Copy the recency stamps first, searches keep updating them while this sorts
+    struct Location {
+        uint64_t lastUsed;
+        string root;
+        size_t index;
+    };
+    vector<Location> spilled;
+    for (const auto &entry : current->shards) {
+        for (size_t i = 0; i < entry.second->segments.size(); i++) {
+            const IndexSegment &segment = *entry.second->segments[i];
+            if (segment.isSpilled()) 
+                spilled.push_back({segment.lastUsed.load(), entry.first, i});
+        }
+    }
+    sort(spilled.begin(), spilled.end(), [](const Location &a, const Location &b) {
+        return a.lastUsed > b.lastUsed;
+    });
+
+    for (const auto &location : spilled) {
+        auto shard = currentSnapshot()->shards.at(location.root);
+        const IndexSegment &segment = *shard->segments[location.index];
+        if (memoryBudget > 0 && residentBytes + segment.bytes > memoryBudget / 2) 
+            continue;
+
+        auto resident = make_shared<IndexSegment>();
+        resident->minKey = segment.minKey;
+        resident->maxKey = segment.maxKey;
+        resident->bytes = segment.bytes;
+        resident->lastUsed = segment.lastUsed.load();
+        forEachRecord(segment, [&resident](const FileData &fd) {
+            resident->indexByName[fd.name].push_back(fd);
+            resident->fileCount++;
+        });
+
+        if (resident->fileCount != segment.fileCount) {
+            cout << "Warning: Could not read spilled index " << segment.run->filePath << ", keeping it on disk" << endl;
+            continue;
+        }
+
+        residentBytes += resident->bytes;
+        auto next = make_shared<RootShard>(*shard);
+        next->segments[location.index] = resident;
+        publishShard(next->root, next);
+    }
+}
+
+void FileManager::displayIndexStats() {
+    IndexStats stats = getIndexStats();
+
+    cout << "=== Index Memory ===" << endl;
+    cout << "  Folders: " << stats.shards << ", segments: " << stats.segments 
+        << " (" << stats.spilledSegments << " on disk)" << endl;
+    cout << "  In memory: " << formatFileSize(stats.residentBytes) << ", block cache: " 
+        << formatFileSize(stats.cachedBytes) << endl;
+    cout << "  Cache hits: " << stats.cacheHits << ", misses: " << stats.cacheMisses << endl;
+}
+
+void FileManager::setPruneRules(const PruneRules &rules) {
+    lock_guard<mutex> guard(pruneMutex);
+    pruneRules = rules;
+    pruneMatcher.compile(rules.excludePatterns, rules.ignoreCase);
+
+    pruneCounters.assign(kPruneRuleCount + rules.excludePatterns.size(), PruneCounter());
+    pruneCounters[kPruneHidden].rule = "hidden entries";
+    pruneCounters[kPruneDepth].rule = "max depth " + to_string(rules.maxDepth);
+    pruneCounters[kPruneFilesystem].rule = "other filesystems";
+    pruneCounters[kPruneMinSize].rule = "smaller than " + formatFileSize(rules.minFileSize);
+    pruneCounters[kPruneMaxSize].rule = "larger than " + formatFileSize(rules.maxFileSize);
+    for (size_t i = 0; i < rules.excludePatterns.size(); i++) {
+        pruneCounters[kPruneRuleCount + i].rule = "exclude " + trim(rules.excludePatterns[i]);
+    }
+}
+
+// Read rules from an ignore file: one glob per line, '#' comments,
+// and options written as "@max-depth 5", "@min-size 1K", "@max-size 2G",
+// "@one-filesystem", "@skip-hidden", "@ignore-case" or "@match-case".
+// Negated "!pattern" lines aren't supported and are skipped with a warning.
+bool FileManager::loadPruneRules(const string &filePath) {
+    ifstream in(filePath);
+    if (!in.is_open()) {
+        return false;
+    }
+
+    PruneRules rules;
+    string line;
+    while (getline(in, line)) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#') 
+            continue;
+
+        if (line[0] == '!') {
+            cout << "Warning: Negated pattern '" << line << "' in " << filePath << " is not supported, ignoring it" << endl;
+            continue;
+        }
+        if (line[0] != '@') {
+            rules.excludePatterns.push_back(line);
+            continue;
+        }
+
+        size_t space = line.find(' ');
+        string option = line.substr(1, space == string::npos ? string::npos : space - 1);
+        string value = space == string::npos ? "" : trim(line.substr(space + 1));
+
+        if (option == "max-depth") {
+            rules.maxDepth = atoi(value.c_str());
+        } else if (option == "min-size") {
+            rules.minFileSize = parseFileSize(value);
+        } else if (option == "max-size") {
+            rules.maxFileSize = parseFileSize(value);
+        } else if (option == "one-filesystem") {
+            rules.oneFilesystem = true;
+        } else if (option == "skip-hidden") {
+            rules.skipHidden = true;
+        } else if (option == "ignore-case") {
+            rules.ignoreCase = true;
+        } else if (option == "match-case") {
+            rules.ignoreCase = false;
+        } else {
+            cout << "Warning: Unknown prune option '" << option << "' in " << filePath << endl;
+        }
+    }
+
+    setPruneRules(rules);
+    return true;
+}
+
+vector<PruneCounter> FileManager::getPruneStats() const {
+    lock_guard<mutex> guard(pruneMutex);
+    return pruneCounters;
+}
+
+void FileManager::displayPruneStats() {
+    PruneRules rules;
+    vector<PruneCounter> counters;
+    {
+        lock_guard<mutex> guard(pruneMutex);
+        rules = pruneRules;
+        counters = pruneCounters;
+    }
+
+    if (counters.empty()) {
+        return;
+    }
+
+    // Only list rules that are switched on
+    bool enabled[kPruneRuleCount] = {
+        rules.skipHidden,
+        rules.maxDepth >= 0,
+        rules.oneFilesystem,
+        rules.minFileSize > 0,
+        rules.maxFileSize > 0,
+    };
+
+    cout << "=== Pruned While Indexing ===" << endl;
+    for (size_t i = 0; i < counters.size(); i++) {
+        if (i < kPruneRuleCount && !enabled[i]) 
+            continue;
+        cout << "  " << counters[i].rule << ": " << counters[i].dirs << " folders, " 
+            << counters[i].files << " files" << endl;
+    }
+}
+
+void FileManager::setSpillDirectory(const string &dirPath) {
+    lock_guard<mutex> guard(indexMutex);
+    spillDirectory = dirPath;
+}
+
+IndexStats FileManager::getIndexStats() const {
+    IndexStats stats = {};
+    auto current = currentSnapshot();
+    stats.shards = current->shards.size();
+    for (const auto &entry : current->shards) {
+        stats.segments += entry.second->segments.size();
+        for (const auto &segment : entry.second->segments) {
+            if (segment->isSpilled()) 
+                stats.spilledSegments++;
+        }
+    }
+    stats.residentBytes = residentBytes;
+    blockCache.readCounters(stats.cacheHits, stats.cacheMisses, stats.cachedBytes);
+    return stats;
+}
+
+// Visit every record of a segment, reading spilled runs sequentially past the block cache
+void FileManager::forEachRecord(const IndexSegment &segment, const function<void(const FileData &)> &visit) {
+    if (!segment.isSpilled()) {
+        for (const auto &entry : segment.indexByName) {
+            for (const auto &fd : entry.second) {
+                visit(fd);
+            }
+        }
+        return;
+    }
+
+    ifstream in(segment.run->filePath, ios::binary);
+    FileData fd;
+    for (size_t i = 0; i < segment.fileCount && readRecord(in, fd); i++) {
+        visit(fd);
+    }
+}
+
+// Write one shard to its own file so it can be reloaded without crawling
+bool FileManager::saveShard(const string &rootPath, const string &filePath) {
+    // Saving works from a snapshot, so it neither blocks nor is blocked by indexing
+    auto current = currentSnapshot();
+    auto found = current->shards.find(shardKey(rootPath));
+    if (found == current->shards.end()) {
+        cout << "Error: Root is not indexed: " << rootPath << endl;
+        return false;
+    }
+    const RootShard &shard = *found->second;
+
+    ofstream out(filePath, ios::binary);
+    if (!out.is_open()) {
+        cout << "Error: Could not open file for saving index." << endl;
+        return false;
+    }
+
+    uint64_t count = shard.fileCount;
+    out.write(kShardMagic, sizeof(kShardMagic));
+    writeString(out, shard.root);
+    out.write((const char *)&count, sizeof(count));
+
+    for (const auto &segment : shard.segments) {
+        forEachRecord(*segment, [&out](const FileData &fd) {
+            writeRecord(out, fd);
+        });
+    }
+
+    out.close();
+    return !out.fail();
+}
+
+bool FileManager::loadShard(const string &filePath) {
+    ifstream in(filePath, ios::binary);
+    if (!in.is_open()) {
+        cout << "Error: Could not open index file: " << filePath << endl;
+        return false;
+    }
+
+    char magic[sizeof(kShardMagic)];
+    string root;
+    uint64_t count = 0;
+    if (!in.read(magic, sizeof(magic)) || !equal(magic, magic + sizeof(magic), kShardMagic) ||
+        !readString(in, root) || !in.read((char *)&count, sizeof(count))) {
+        cout << "Error: Not a valid index file: " << filePath << endl;
+        return false;
+    }
+
+    // A count the file can't possibly hold means it is corrupt or foreign
+    error_code ec;
+    uintmax_t fileBytes = file_size(filePath, ec);
+    if (ec || count > fileBytes / kMinRecordBytes) {
+        cout << "Error: Not a valid index file: " << filePath << endl;
+        return false;
+    }
+
+    ShardBuilder builder;
+    builder.shard.root = root;
+    FileData fd;
+    for (uint64_t i = 0; i < count; i++) {
+        if (!readRecord(in, fd)) {
+            cout << "Error: Index file is truncated: " << filePath << endl;
+            // Drop whatever was sealed while loading
+            for (const auto &segment : builder.shard.segments) {
+                if (!segment->isSpilled()) 
+                    residentBytes -= segment->bytes;
+            }
+            return false;
+        }
+        addToShard(builder, fd);
+    }
+
+    lock_guard<mutex> guard(indexMutex);
+    finishShard(builder);
+    installShard(builder.shard, false);
+    return true;
+}
+
+// Save shards built or refreshed since the last save, each into its own file,
+// and delete the files of dropped roots. Unchanged shards aren't rewritten.
+bool FileManager::saveIndex(const string &dirPath) {
+    set<string> unsaved;
+    set<string> dropped;
+    {
+        lock_guard<mutex> guard(indexMutex);
+        unsaved = unsavedRoots;
+        dropped = droppedRoots;
+    }
+
+    error_code ec;
+    create_directories(dirPath, ec);
+
+    for (const string &root : dropped) {
+        remove(path(dirPath) / shardFileName(root), ec);
+    }
+
+    bool saved = true;
+    vector<pair<string, shared_ptr<const RootShard>>> written;
+    for (const string &root : unsaved) {
+        auto current = currentSnapshot();
+        auto found = current->shards.find(root);
+        if (found == current->shards.end()) 
+            continue;
+
+        if (saveShard(root, (path(dirPath) / shardFileName(root)).string())) {
+            written.emplace_back(root, found->second);
+        } else {
+            saved = false;
+        }
+    }
+
+    // Roots rebuilt while saving stay marked for the next save
+    lock_guard<mutex> guard(indexMutex);
+    for (const string &root : dropped) {
+        droppedRoots.erase(root);
+    }
+    auto current = currentSnapshot();
+    for (const auto &entry : written) {
+        auto found = current->shards.find(entry.first);
+        if (found != current->shards.end() && found->second == entry.second) 
+            unsavedRoots.erase(entry.first);
+    }
+    return saved;
+}
+
+// Load every saved shard in a folder, returns how many were loaded
+size_t FileManager::loadIndex(const string &dirPath) {
+    size_t loaded = 0;
+    error_code ec;
+
+    for (const auto &entry : directory_iterator(dirPath, ec)) {
+        if (entry.path().extension() == ".idx" && loadShard(entry.path().string())) 
+            loaded++;
+    }
+    return loaded;
+}
+
+void FileManager::searchSegment(const IndexSegment &segment, const string &prefixLower, vector<FileData> &results) {
+    if (!segment.isSpilled()) {
+        for (const auto &entry : segment.indexByName) {
+            string nameLower = toLower(entry.first);
+
+            if (nameLower.find(prefixLower) == 0) {
+                results.insert(results.end(), entry.second.begin(), entry.second.end());
+            }
+        }
+        return;
+    }
+
+    // Start at the block before the first key >= prefix, stop once keys sort past it
+    const SpillRun &run = *segment.run;
+    size_t first = lower_bound(run.blockFirstKey.begin(), run.blockFirstKey.end(), prefixLower) - run.blockFirstKey.begin();
+    if (first > 0) 
+        first--;
+
+    for (size_t b = first; b < run.blockFirstKey.size(); b++) {
+        if (b > first && run.blockFirstKey[b].compare(0, prefixLower.size(), prefixLower) > 0) 
+            break;
+
+        auto records = blockCache.get(run, b);
+        for (const auto &fd : *records) {
+            if (toLower(fd.name).compare(0, prefixLower.size(), prefixLower) == 0) {
+                results.push_back(fd);
+            }
+        }
+    }
+}
+
+vector<FileData> FileManager::searchShard(const RootShard &shard, const string &prefixLower, uint64_t now) {
+    vector<FileData> results;
+
+    for (const auto &segment : shard.segments) {
+        if (!segment->canMatch(prefixLower)) 
+            continue;
+
+        segment->lastUsed = now;
+        searchSegment(*segment, prefixLower, results);
+    }
+    return results;
+}
+
+vector<FileData> FileManager::searchFiles(const string &fileName, bool silent) {
+    vector<FileData> results;
+    string searchLower = toLower(fileName);
+    uint64_t now = ++useClock;
+
+    // Pin the current snapshot, re-indexing can publish newer ones meanwhile
+    auto current = currentSnapshot();
+
+    // Search for files starting with the given name, skipping shards whose range can't match
+    vector<const RootShard *> targets;
+    for (const auto &entry : current->shards) {
+        if (entry.second->canMatch(searchLower)) 
+            targets.push_back(entry.second.get());
+    }
+
+    if (targets.size() == 1) {
+        results = searchShard(*targets[0], searchLower, now);
+    } else {
+        // Fan out one task per shard and merge in root order
+        vector<future<vector<FileData>>> pending;
+        for (const RootShard *shard : targets) {
+            pending.push_back(async(launch::async, &FileManager::searchShard, this, cref(*shard), cref(searchLower), now));
+        }
+        for (auto &part : pending) {
+            vector<FileData> found = part.get();
+            results.insert(results.end(), found.begin(), found.end());
+        }
+    }
+
+    if (!silent) {
+        displaySearchResults(results);
+    }
+
+    return results;
+}
+
+void FileManager::displaySearchResults(const vector<FileData> &results) {
+    if (results.empty()) {
+        cout << "No files found." << endl;
+        return;
+    }
+
+    cout << "\nFound " << results.size() << " file(s):" << endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        cout << "--- File " << i + 1 << " ---" << endl;
+        cout << "Name: " << results[i].name << endl;
+        cout << "Path: " << results[i].path << endl;
+        cout << "Size: " << formatFileSize(results[i].size) << endl;
+        cout << "Last Modified: " << formatTime(results[i].lastModified) << endl;
+        cout << endl;
+    }
+}
+
+vector<FileData> FileManager::analyzeStorage(const string &folderPath, int numFiles, int sortChoice) {
+    cout << "=== Analyzing Storage for: " << folderPath << " ===" << endl;
+    
+    if (!exists(folderPath) || !is_directory(folderPath)) {
+        cout << "Invalid folder path!" << endl;
+        return {};
+    }
+
+    cout << "Scanning files..." << endl;
+
+    // Collect all files
+    vector<FileData> allFiles = collectFilesFromPath(folderPath);
+    
+    if (allFiles.empty()) {
+        cout << "No files found in this folder." << endl;
+        return {};
+    }
+    
+    // Calculate total size
+    size_t totalSize = 0;
+    for (const auto &file : allFiles) {
+        totalSize += file.size;
+    }
+
+    cout << "=== Folder Summary ===" << endl;
+    cout << "Total files: " << allFiles.size() << endl;
+    cout << "Total size: " << formatFileSize(totalSize) << endl;
+    cout << endl;
+
+    cout << "=== File Type Breakdown ===" << endl;
+    map<string, int> fileTypes;
+    map<string, size_t> typeSizes;
+
+    for (const auto &file : allFiles) {
+        size_t dotPos = file.name.find_last_of(".");
+        string ext = (dotPos != string::npos) ? file.name.substr(dotPos + 1) : "no extension";
+        fileTypes[ext]++;
+        typeSizes[ext] += file.size;
+    }
+
+    for (const auto &type : fileTypes) {
+        cout << "  ." << type.first << ": " << type.second << " files (" 
+            << formatFileSize(typeSizes[type.first]) << ")" << endl;
+    }
+
+    cout << "File type breakdown complete." << endl;
+    
+    // Sort files based on choice 
+    if (sortChoice == 1) {
+        // Sort by size using standard library sort
+        sort(allFiles.begin(), allFiles.end(), [](const FileData &a, const FileData &b) {
+            return a.size > b.size;
+        });
+    } else if (sortChoice == 2) {
+        // Sort by date
+        sort(allFiles.begin(), allFiles.end(), [](const FileData &a, const FileData &b) {
+            return a.lastModified > b.lastModified;
+        });
+    }
+    
+    cout << "=== Sorted Files ===" << endl;
+
+    size_t limit = min((size_t)numFiles, allFiles.size());
+    
+    for (size_t i = 0; i < limit; i++) {
+        cout << i + 1 << ". " << allFiles[i].name << " - " << formatFileSize(allFiles[i].size) << endl;
+    }
+    cout << endl;
+
+    return allFiles;
+}
+
+bool FileManager::exportAnalysis(const vector<FileData> &files, const string &exportPath) {
+    ofstream outFile(exportPath);
+    if (!outFile.is_open()) {
+        cout << "Error: Could not open file for exporting." << endl;
+        return false;
+    }
+
+    outFile << "Name,Path,Size (Bytes),Last Modified" << endl;
+
+    for (const auto &file : files) {
+        outFile << "\"" << file.name << "\","
+                << "\"" << file.path << "\","
+                << file.size << ","
+                << formatTime(file.lastModified) << "\n";
+    }
+
+    outFile.close();
+    cout << "Analysis exported successfully to: " << exportPath << endl;
+    return true;
+}
+
+// Helper to select a file from multiple results
+string FileManager::selectFileFromResults(const vector<FileData> &results, const string &operation) {
+    if (results.empty()) {
+        return "";
+    }
+    
+    if (results.size() == 1) {
+        return results[0].path;
+    }
+    
+    cout << "\nMultiple files found." << endl;
+    cout << "Enter file number to " << operation << " (0 to cancel): ";
+    int choice;
+    cin >> choice;
+    cin.ignore();
+    
+    if (choice < 1 || choice > (int)results.size()) {
+        cout << "Cancelled.\n";
+        return "";
+    }
+    
+    return results[choice - 1].path;
+}
+
+bool FileManager::openFile(const string &filePath) {
+    cout << "Opening file: " << filePath << endl;
+    
+    string command = "start \"\" \"" + filePath + "\"";
+    system(command.c_str());
+    
+    return true;
+}
+
+bool FileManager::insertText(const string &filePath) {
+    // Check if file is a text file
+    path fp(filePath);
+    string extension = fp.extension().string();
+    transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    
+    // Only allow these specific file types
+    vector<string> textExtensions = {".txt", ".csv", ".json", ".md"};
+    
+    bool isTextFile = false;
+    for (const auto &ext : textExtensions) {
+        if (extension == ext) {
+            isTextFile = true;
+            break;
+        }
+    }
+    
+    if (!isTextFile) {
+        cout << "Error: Cannot insert text into '" << extension << "' files." << endl;
+        cout << "Text insertion is only supported for: .txt, .csv, .json, .md files" << endl;
+        return false;
+    }
+
+    cout << "Enter text to append (press ENTER on empty line to finish):\n";
+
+    string content = "";
+    string line;
+    bool firstLine = true;
+
+    while (true) {
+        getline(cin, line);
+        if (line.empty()) break;
+        
+        if (!firstLine) {
+            content += "\n";
+        }
+        content += line;
+        firstLine = false;
+    }
+    
+    if (content.empty()) {
+        cout << "No text entered. Cancelled." << endl;
+        return false;
+    }
+
+    ofstream file(filePath, ios::app);
+    if (!file.is_open()) {
+        cout << "Error: Could not open file for writing.\n";
+        return false;
+    }
+
+    file << "\n" << content << "\n";
+    file.close();
+
+    cout << "Text appended successfully to: " << filePath << endl;
+    return true;
+}
+
+bool FileManager::moveFile(const string &sourcePath, const string &newPath, const string &userProfile) {
+    string destFolder = newPath;
+    
+    if (!exists(destFolder)) {
+        // Capitalize first letter, lowercase the rest
+        string normalized = newPath;
+        transform(normalized.begin(), normalized.end(), normalized.begin(), ::tolower);
+        normalized[0] = toupper(normalized[0]);
+        
+        destFolder = userProfile + "\\" + normalized;
+        
+        if (!exists(destFolder)) {
+            cout << "Error: Destination folder not found: " << newPath << endl;
+            cout << "Tried: " << destFolder << endl;
+            cout << "Use full path or ensure folder exists in user profile." << endl;
+            return false;
+        }
+    }
+    
+    if (!is_directory(destFolder)) {
+        cout << "Error: '" << destFolder << "' is not a folder." << endl;
+        return false;
+    }
+
+    path source(sourcePath);
+    string filename = source.filename().string();
+    path destination = path(destFolder) / filename;
+    
+    if (exists(destination)) {
+        cout << "Warning: File already exists at destination. Overwrite? (y/n): ";
+        string confirm;
+        getline(cin, confirm);
+        if (confirm != "y" && confirm != "Y") {
+            cout << "Cancelled." << endl;
+            return false;
+        }
+    }
+
+    try {
+        rename(sourcePath, destination.string());
+        cout << "File moved successfully to: " << destination.string() << endl;
+        return true;
+    }
+    catch (const filesystem_error &e) {
+        cout << "Move failed: " << e.what() << endl;
+        return false;
+    }
+}
+
+bool FileManager::safeDelete(const string &filePath) {
+    // Confirmation before deleting permanently
+    cout << "Delete " << filePath << "? (y/n): ";
+    string confirm;
+    getline(cin, confirm);
+
+    if (confirm != "y" && confirm != "Y") {
+        cout << "Cancelled.\n";
+        return false;
+    }
+
+    try {
+        remove(filePath);
+        cout << "Deleted: " << filePath << "\n";
+        return true;
+    } catch (const filesystem_error &e) {
+        cout << "Failed: " << e.what() << endl;
+        return false;
+    }
+}
+
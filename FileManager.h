@@ -0,0 +1,242 @@
+#ifndef FILEMANAGER_H
+#define FILEMANAGER_H
+
+#include <map>
+#include <set>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+using namespace std; 
+
+struct FileData {
+    string name;
+    string path;
+    size_t size;
+    time_t lastModified;
+};
+
+// On-disk run holding one spilled index segment.
+// Records are sorted by lowercase name and grouped into fixed-size blocks,
+// only the first key and offset of each block stay in memory.
+struct SpillRun {
+    uint64_t id;
+    string filePath;
+    vector<string> blockFirstKey;
+    vector<uint64_t> blockOffset;
+    vector<uint32_t> blockCount;
+
+    ~SpillRun();
+};
+
+// A slice of the index, either resident in memory or spilled to a run.
+// Immutable once published, except for the search recency stamp.
+struct IndexSegment {
+    string minKey;          // lowercase name range, used to skip segments
+    string maxKey;
+    size_t fileCount = 0;
+    size_t bytes = 0;       // estimated memory while resident
+    mutable atomic<uint64_t> lastUsed{0};
+
+    unordered_map<string, vector<FileData>> indexByName;   // empty once spilled
+    shared_ptr<SpillRun> run;
+
+    bool isSpilled() const { return run != nullptr; }
+    bool canMatch(const string &prefixLower) const;
+};
+
+// Everything indexed under one root, built and dropped independently
+struct RootShard {
+    string root;
+    vector<shared_ptr<const IndexSegment>> segments;
+    size_t fileCount = 0;
+
+    bool canMatch(const string &prefixLower) const;
+};
+
+// A shard being built. Files go to one open segment per name range, so
+// sealed segments cover narrow key ranges that searches can skip.
+struct ShardBuilder {
+    RootShard shard;
+    vector<shared_ptr<IndexSegment>> open;
+    size_t openBytes = 0;
+};
+
+// Immutable view of all shards. Searches hold a reference to the snapshot
+// they started on, writers publish a new one with a single atomic swap.
+struct IndexSnapshot {
+    map<string, shared_ptr<const RootShard>> shards;
+};
+
+// LRU cache of decoded blocks read back from spill runs
+class BlockCache {
+public:
+    void setCapacity(size_t bytes);
+    shared_ptr<const vector<FileData>> get(const SpillRun &run, size_t block);
+    void clear();
+    void readCounters(size_t &hitCount, size_t &missCount, size_t &bytes) const;
+
+private:
+    struct Entry {
+        string key;
+        shared_ptr<const vector<FileData>> records;
+        size_t bytes;
+    };
+
+    void evict();
+
+    mutable mutex cacheMutex;
+    size_t capacity = 0;
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t usedBytes = 0;
+    list<Entry> lru;
+    unordered_map<string, list<Entry>::iterator> lookup;
+};
+
+// Crawl pruning options, excluded directories are cut off before they are opened
+struct PruneRules {
+    vector<string> excludePatterns;    // gitignore-style globs, a trailing '/' matches directories only
+    int maxDepth = -1;                 // -1 is unlimited, 0 keeps only files directly in the root
+    uintmax_t minFileSize = 0;
+    uintmax_t maxFileSize = 0;         // 0 is unlimited
+    bool oneFilesystem = false;        // don't cross into other devices or mounts
+    bool skipHidden = false;
+#ifdef _WIN32
+    bool ignoreCase = true;            // Windows names are case-insensitive, like git's core.ignorecase
+#else
+    bool ignoreCase = false;
+#endif
+};
+
+// How much one rule saved during crawls
+struct PruneCounter {
+    string rule;
+    size_t dirs = 0;
+    size_t files = 0;
+};
+
+// Exclude patterns compiled into hash lookups for plain names and extensions,
+// only patterns with real wildcards fall back to glob matching
+class PruneMatcher {
+public:
+    // Negated "!pattern" entries aren't supported and never match
+    void compile(const vector<string> &patterns, bool ignoreCase);
+    // Index of the first pattern that excludes the entry, or -1
+    int match(const string &name, const string &relativePath, bool isDir) const;
+
+private:
+    struct Rule {
+        string glob;
+        bool dirOnly;
+        bool anchored;      // matched against the path from the root instead of the name
+    };
+
+    bool ruleMatches(size_t index, const string &name, const string &relativePath, bool isDir) const;
+
+    bool ignoreCase = false;
+    vector<Rule> rules;
+    unordered_map<string, vector<size_t>> byName;
+    unordered_map<string, vector<size_t>> byExtension;
+    vector<size_t> globRules;
+};
+
+struct IndexStats {
+    size_t shards;
+    size_t segments;
+    size_t spilledSegments;
+    size_t residentBytes;
+    size_t cachedBytes;
+    size_t cacheHits;
+    size_t cacheMisses;
+};
+
+// Helper functions
+string trim(const string &str);
+string formatFileSize(size_t bytes);
+string formatTime(time_t t);
+
+class FileManager {
+public:
+    void buildIndex(const string &rootPath);
+    void buildFullIndex(const vector<string> &paths, bool refresh = false);
+    bool dropRoot(const string &rootPath);
+    vector<string> indexedRoots() const;
+
+    bool saveShard(const string &rootPath, const string &filePath);
+    bool loadShard(const string &filePath);
+    bool saveIndex(const string &dirPath);
+    size_t loadIndex(const string &dirPath);
+
+    void setPruneRules(const PruneRules &rules);
+    bool loadPruneRules(const string &filePath);
+    vector<PruneCounter> getPruneStats() const;
+    void displayPruneStats();
+
+    vector<FileData> searchFiles(const string &fileName, bool silent = false);
+
+    void displaySearchResults(const vector<FileData> &results);
+    vector<FileData> analyzeStorage(const string &folderPath, int numFiles, int sortChoice);
+    bool exportAnalysis(const vector<FileData> &files, const string &exportPath);
+
+
+    bool openFile(const string &filePath);
+    bool insertText(const string &filePath);
+    bool safeDelete(const string &filePath);
+    bool moveFile(const string &sourcePath, const string &newPath, const string &userProfile);
+
+    vector<FileData> collectFilesFromPath(const string &rootPath);
+    string selectFileFromResults(const vector<FileData> &results, const string &operation);
+
+    bool sendFile(const string &filePath);
+
+    // Memory budget for the index in bytes, 0 means unlimited
+    void setMemoryBudget(size_t bytes);
+    void setSpillDirectory(const string &dirPath);
+    IndexStats getIndexStats() const;
+    void displayIndexStats();
+
+private:
+    void walkFiles(const string &rootPath, const function<void(const FileData &)> &visit, bool applyPrune);
+    shared_ptr<const IndexSnapshot> currentSnapshot() const;
+    // Fills a private builder, takes indexMutex only to seal a segment
+    void addToShard(ShardBuilder &builder, const FileData &fd);
+
+    // Writers below expect indexMutex to be held
+    void publishShard(const string &root, shared_ptr<const RootShard> shard);
+    void sealSegment(ShardBuilder &builder, size_t bucket);
+    void finishShard(ShardBuilder &builder);
+    void installShard(RootShard &shard, bool unsaved = true);
+    bool removeShard(const string &root);
+    void enforceMemoryBudget(RootShard *building = nullptr);
+    shared_ptr<const IndexSegment> spillSegment(const IndexSegment &segment);
+    void pageInSegments();
+
+    void forEachRecord(const IndexSegment &segment, const function<void(const FileData &)> &visit);
+    void searchSegment(const IndexSegment &segment, const string &prefixLower, vector<FileData> &results);
+    vector<FileData> searchShard(const RootShard &shard, const string &prefixLower, uint64_t now);
+
+    // Readers load this without locking, only writers take indexMutex
+    shared_ptr<const IndexSnapshot> snapshot = make_shared<IndexSnapshot>();
+    mutex indexMutex;
+    atomic<size_t> memoryBudget{0};
+    atomic<size_t> residentBytes{0};
+    atomic<uint64_t> useClock{0};
+    string spillDirectory;
+    BlockCache blockCache;
+    set<string> unsavedRoots;      // built since the last saveIndex
+    set<string> droppedRoots;      // whose saved files saveIndex deletes
+
+    mutable mutex pruneMutex;
+    PruneRules pruneRules;
+    PruneMatcher pruneMatcher;
+    vector<PruneCounter> pruneCounters;
+};
+
+#endif
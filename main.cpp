@@ -1,5 +1,7 @@
 #include <vector>
 #include <string>
+#include <cstdlib>
+#include <sstream>
 #include <fstream>
 #include <iostream>
 
@@ -11,6 +13,9 @@ int main() {
     FileManager fm;
     string userProfile = getenv("USERPROFILE");
 
+    // Optional crawl exclusions, see README
+    bool hasPruneRules = fm.loadPruneRules(userProfile + "\\.arisignore");
+
     cout << "=== ARIS: File Search & Management System ===" << endl;
     cout << "Select a mode:" << endl;
     cout << "1. File Search" << endl;
@@ -58,8 +63,55 @@ int main() {
             addMore = trim(addMore);
         } 
 
+        // Optional cap on index memory, colder parts spill to disk beyond it
+        const char *budgetMb = getenv("ARIS_INDEX_BUDGET_MB");
+        bool hasBudget = budgetMb != nullptr && atoll(budgetMb) > 0;
+        if (hasBudget) {
+            fm.setMemoryBudget((size_t)atoll(budgetMb) * 1024 * 1024);
+        }
+
+        // Reuse the index saved by the last run, only new folders get crawled
+        string indexDir = userProfile + "\\.aris_index";
+        bool refreshAll = false;
+        fm.loadIndex(indexDir);
+        vector<string> savedRoots = fm.indexedRoots();
+
+        if (!savedRoots.empty()) {
+            cout << "Loaded saved index for:" << endl;
+            for (size_t i = 0; i < savedRoots.size(); i++) {
+                cout << i + 1 << ". " << savedRoots[i] << endl;
+            }
+            cout << "Refresh which folders? (numbers separated by spaces, 'a' for all, ENTER for none): ";
+
+            string refreshChoice;
+            getline(cin, refreshChoice);
+            refreshChoice = trim(refreshChoice);
+
+            if (refreshChoice == "a" || refreshChoice == "A") {
+                refreshAll = true;
+            } else {
+                istringstream choices(refreshChoice);
+                int choice;
+                while (choices >> choice) {
+                    if (choice < 1 || choice > (int)savedRoots.size()) {
+                        cout << "Skipping invalid choice: " << choice << endl;
+                        continue;
+                    }
+                    cout << "Refreshing: " << savedRoots[choice - 1] << "..." << endl;
+                    fm.buildIndex(savedRoots[choice - 1]);
+                }
+            }
+        }
+
         cout << "Building file index..." << endl;
-        fm.buildFullIndex(searchPaths);
+        fm.buildFullIndex(searchPaths, refreshAll);
+        fm.saveIndex(indexDir);
+        if (hasPruneRules) {
+            fm.displayPruneStats();
+        }
+        if (hasBudget) {
+            fm.displayIndexStats();
+        }
 
         while (true) {
         cout << "\nEnter file name to search (or 'quit' to exit): ";
@@ -67,8 +119,12 @@ int main() {
         getline(cin, fileName);
         fileName = trim(fileName);
 
-        if (fileName == "quit" || fileName == "exit" || fileName == "q")
+        if (fileName == "quit" || fileName == "exit" || fileName == "q") {
+            if (hasBudget) {
+                fm.displayIndexStats();
+            }
             break;
+        }
 
         vector<FileData> results = fm.searchFiles(fileName);
         
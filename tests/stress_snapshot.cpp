@@ -0,0 +1,123 @@
+// Stress test for snapshot reads during re-indexing.
+// Many threads search while one thread keeps rebuilding and spilling the index.
+// Every search must see a complete snapshot, so result counts never change.
+// Build and run under ThreadSanitizer, see README.
+
+#include <map>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+
+#include "FileManager.h"
+
+using namespace std;
+using namespace std::filesystem;
+
+static const int kRoots = 4;
+static const int kDirsPerRoot = 5;
+static const int kFilesPerDir = 200;
+static const int kSearchers = 8;
+static const int kReindexRounds = 20;
+
+// Create a tree of small files with names spread over the alphabet
+static vector<string> buildTree(const path &base) {
+    vector<string> roots;
+    const string letters = "abcdexyzABC_0";
+
+    for (int r = 0; r < kRoots; r++) {
+        path root = base / ("root" + to_string(r));
+        roots.push_back(root.string());
+
+        for (int d = 0; d < kDirsPerRoot; d++) {
+            path dir = root / ("dir" + to_string(d));
+            create_directories(dir);
+
+            for (int f = 0; f < kFilesPerDir; f++) {
+                string name;
+                name += letters[(r + d + f) % letters.size()];
+                name += letters[(f * 7 + d) % letters.size()];
+                name += "_" + to_string(f) + ".txt";
+
+                ofstream out(dir / name);
+                out << string(f % 50, 'x');
+            }
+        }
+    }
+    return roots;
+}
+
+int main() {
+    path base = temp_directory_path() / ("aris_stress_" + to_string(chrono::steady_clock::now().time_since_epoch().count()));
+    vector<string> roots = buildTree(base);
+    vector<string> queries = {"", "a", "ab", "x", "yz", "_", "0", "c_1", "nothing"};
+
+    // Expected counts from an index nobody touches
+    FileManager reference;
+    reference.buildFullIndex(roots);
+    map<string, size_t> expected;
+    for (const string &query : queries) {
+        expected[query] = reference.searchFiles(query, true).size();
+    }
+
+    // Small budget so re-indexing keeps spilling and publishing new shard versions
+    FileManager fm;
+    fm.setSpillDirectory((base / "spill").string());
+    fm.setMemoryBudget(256 * 1024);
+    fm.buildFullIndex(roots);
+
+    atomic<bool> stop{false};
+    atomic<size_t> searches{0};
+    atomic<size_t> failures{0};
+
+    vector<thread> searchers;
+    for (int t = 0; t < kSearchers; t++) {
+        searchers.emplace_back([&, t]() {
+            size_t i = t;
+            while (!stop) {
+                const string &query = queries[i++ % queries.size()];
+                size_t found = fm.searchFiles(query, true).size();
+                if (found != expected[query]) {
+                    failures++;
+                    cout << "FAIL: '" << query << "' found " << found << ", expected " << expected[query] << endl;
+                }
+                fm.getIndexStats();
+                searches++;
+            }
+        });
+    }
+
+    thread reindexer([&]() {
+        for (int round = 0; round < kReindexRounds; round++) {
+            if (round % 5 == 0) {
+                fm.buildFullIndex(roots, true);
+            } else {
+                fm.buildIndex(roots[round % roots.size()]);
+            }
+            fm.setMemoryBudget(round % 2 ? 128 * 1024 : 512 * 1024);
+        }
+        stop = true;
+    });
+
+    reindexer.join();
+    for (auto &searcher : searchers) {
+        searcher.join();
+    }
+
+    IndexStats stats = fm.getIndexStats();
+    cout << "Searches: " << searches << ", failures: " << failures << endl;
+    cout << "Segments: " << stats.segments << " (" << stats.spilledSegments << " spilled), cache hits: "
+        << stats.cacheHits << ", misses: " << stats.cacheMisses << endl;
+
+    error_code ec;
+    remove_all(base, ec);
+
+    if (failures > 0 || searches == 0) {
+        cout << "Stress test FAILED" << endl;
+        return 1;
+    }
+    cout << "Stress test passed" << endl;
+    return 0;
+}